@@ -15,7 +15,7 @@ plt.yticks(fontsize = 15 )
 plt.xlabel("R" , fontsize = 30 )
 plt.ylabel("P" , fontsize = 30 )
 
-x,y = np.loadtxt("Pizza.txt" , skiprows = 1 , unpack = True )
+x,y = np.loadtxt("pizza.txt" , skiprows = 1 , unpack = True )
 plt.plot( x , y ,"bo")
 
 plt.show()